@@ -7,8 +7,36 @@
 #include "ssd1306.h"
 #include <string.h>
 
+#if PAGED_RENDER
+#include "hardware/dma.h"
+#include "hardware/i2c.h"
+#endif
+
 static struct render_area area;
 
+#if PAGED_RENDER
+static uint8_t page_buffer[ssd1306_width];
+static uint16_t page_tx[2][ssd1306_width + 1];
+static int page_dma_channel;
+static dma_channel_config page_dma_config;
+
+/**
+ * @brief Aguarda o fim da transmissão por DMA da última página.
+ *
+ * Necessário antes de qualquer escrita bloqueante no I2C, que desabilita o
+ * periférico e interromperia a transferência em andamento.
+ */
+static void wait_page_transfer(void) {
+    i2c_hw_t *hw = i2c_get_hw(i2c1);
+
+    dma_channel_wait_for_finish_blocking(page_dma_channel);
+    while (!(hw->status & I2C_IC_STATUS_TFE_BITS) || (hw->status & I2C_IC_STATUS_MST_ACTIVITY_BITS)) {
+        tight_loop_contents();
+    }
+    (void)hw->clr_tx_abrt;
+}
+#endif
+
 /**
  * @brief Inicializa o display SSD1306.
  */
@@ -19,6 +47,16 @@ void display_init(void) {
     area.start_page = 0;
     area.end_page = ssd1306_n_pages - 1;
     calculate_render_area_buffer_length(&area);
+
+#if PAGED_RENDER
+    // Palavras de 16 bits: byte de dados + bit de STOP no último byte da página
+    page_dma_channel = dma_claim_unused_channel(true);
+    page_dma_config = dma_channel_get_default_config(page_dma_channel);
+    channel_config_set_transfer_data_size(&page_dma_config, DMA_SIZE_16);
+    channel_config_set_read_increment(&page_dma_config, true);
+    channel_config_set_write_increment(&page_dma_config, false);
+    channel_config_set_dreq(&page_dma_config, i2c_get_dreq(i2c1, true));
+#endif
 }
 
 /**
@@ -26,9 +64,56 @@ void display_init(void) {
  * @param buffer Ponteiro para o buffer de pixels a ser renderizado.
  */
 void display_render(uint8_t *buffer) {
+#if PAGED_RENDER
+    wait_page_transfer();
+#endif
     render_on_display(buffer, &area);
 }
 
+#if PAGED_RENDER
+/**
+ * @brief Renderiza o quadro página a página.
+ *
+ * Em modo de endereçamento horizontal o SSD1306 avança de página sozinho,
+ * então cada página vira uma transação I2C independente (0x40 + 128 bytes).
+ * Dois buffers de transmissão se alternam: enquanto o DMA envia uma página,
+ * a seguinte é desenhada.
+ * @param draw_page Função que desenha cada página.
+ */
+void display_render_paged(display_page_draw_fn draw_page) {
+    wait_page_transfer();
+
+    uint8_t commands[] = {
+        ssd1306_set_column_address, area.start_column, area.end_column,
+        ssd1306_set_page_address, area.start_page, area.end_page
+    };
+    ssd1306_send_command_list(commands, count_of(commands));
+
+    for (int page = area.start_page; page <= area.end_page; page++) {
+        uint16_t *tx = page_tx[page & 1];
+
+        memset(page_buffer, 0, sizeof(page_buffer));
+        draw_page(page_buffer, page);
+
+        tx[0] = 0x40;
+        for (int i = 0; i < ssd1306_width; i++) tx[i + 1] = page_buffer[i];
+        tx[ssd1306_width] |= I2C_IC_DATA_CMD_STOP_BITS;
+
+        // O DMA da página anterior usa o outro buffer de transmissão
+        dma_channel_wait_for_finish_blocking(page_dma_channel);
+        dma_channel_configure(page_dma_channel, &page_dma_config,
+                              &i2c_get_hw(i2c1)->data_cmd, tx, ssd1306_width + 1, true);
+    }
+}
+
+/**
+ * @brief Aguarda o fim do envio da última página.
+ */
+void display_wait_idle(void) {
+    wait_page_transfer();
+}
+#endif
+
 /**
  * @brief Desenha texto no display.
  * @param buffer Ponteiro para o buffer do display.
@@ -38,4 +123,18 @@ void display_render(uint8_t *buffer) {
  */
 void display_draw_text(uint8_t *buffer, int x, int y, const char *text) {
     ssd1306_draw_string(buffer, x, y, (char *)text);
+}
+
+/**
+ * @brief Desenha texto no buffer de uma única página.
+ * @param page_buffer Ponteiro para o buffer da página.
+ * @param page Índice da página.
+ * @param x Posição horizontal inicial do texto.
+ * @param y Posição vertical do texto (coordenada do display).
+ * @param text Texto a ser desenhado.
+ */
+void display_draw_text_page(uint8_t *page_buffer, int page, int x, int y, const char *text) {
+    const int page_height = ssd1306_page_height;
+    if (y / page_height != page) return;
+    ssd1306_draw_string(page_buffer, x, y % page_height, (char *)text);
 }
\ No newline at end of file
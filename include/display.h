@@ -10,6 +10,17 @@
 #include <stdbool.h>
 #include "ssd1306.h"
 
+#ifndef PAGED_RENDER
+#define PAGED_RENDER 0 // 1 para desenhar e enviar o quadro página a página
+#endif
+
+/**
+ * @brief Função que desenha uma página (8 linhas x 128 colunas) do quadro.
+ * @param page_buffer Buffer da página (ssd1306_width bytes, já zerado)
+ * @param page Índice da página do SSD1306
+ */
+typedef void (*display_page_draw_fn)(uint8_t *page_buffer, int page);
+
 /**
  * @brief Inicializa o display SSD1306 via I2C.
  */
@@ -21,6 +32,24 @@ void display_init(void);
  */
 void display_render(uint8_t *buffer);
 
+#if PAGED_RENDER
+/**
+ * @brief Renderiza o quadro página a página, sem framebuffer completo.
+ *
+ * Cada página é desenhada em um buffer pequeno e enviada por DMA ao I2C
+ * enquanto a próxima é desenhada.
+ * @param draw_page Função chamada para desenhar cada página
+ */
+void display_render_paged(display_page_draw_fn draw_page);
+
+/**
+ * @brief Aguarda o fim do envio da última página ao display.
+ *
+ * display_render_paged retorna com a última página ainda em transmissão.
+ */
+void display_wait_idle(void);
+#endif
+
 /**
  * @brief Desenha uma string no display OLED.
  * @param buffer Buffer do display
@@ -30,4 +59,16 @@ void display_render(uint8_t *buffer);
  */
 void display_draw_text(uint8_t *buffer, int x, int y, const char *text);
 
+/**
+ * @brief Desenha uma string no buffer de uma única página.
+ *
+ * O texto só é desenhado se a linha y pertencer à página indicada.
+ * @param page_buffer Buffer da página
+ * @param page Índice da página do SSD1306
+ * @param x Posição X
+ * @param y Posição Y (coordenada do display)
+ * @param text Texto a ser exibido
+ */
+void display_draw_text_page(uint8_t *page_buffer, int page, int x, int y, const char *text);
+
 #endif // DISPLAY_H
\ No newline at end of file
@@ -0,0 +1,134 @@
+/**
+ * @file fb_mirror.c
+ * @brief Implementação do espelhamento do framebuffer via USB CDC.
+ */
+
+#include "fb_mirror.h"
+#include "ssd1306.h"
+#include "pico/stdio_usb.h"
+#include "tusb.h"
+#include <string.h>
+
+#define HEADER_LENGTH 6
+#define RLE_MIN_RUN 3
+#define RLE_MAX_RUN (0x7F + RLE_MIN_RUN)
+#define RLE_MAX_LITERAL 0x80
+#define MAX_PAYLOAD_LENGTH (ssd1306_buffer_length + ssd1306_buffer_length / RLE_MAX_LITERAL + 1)
+
+static uint8_t last_frame[ssd1306_buffer_length];
+static uint8_t packet[HEADER_LENGTH + MAX_PAYLOAD_LENGTH + 1];
+static int packet_length = 0;
+static int packet_sent = 0;
+static uint8_t sequence = 0;
+static uint32_t frame_count = 0;
+static bool need_keyframe = true;
+
+/**
+ * @brief Codifica um bloco de dados em run-length.
+ * @param data Dados de entrada.
+ * @param length Tamanho dos dados de entrada.
+ * @param out Buffer de saída (ao menos MAX_PAYLOAD_LENGTH bytes).
+ * @return Número de bytes escritos em out.
+ */
+static int rle_encode(const uint8_t *data, int length, uint8_t *out) {
+    int i = 0;
+    int o = 0;
+
+    while (i < length) {
+        int run = 1;
+        while (i + run < length && run < RLE_MAX_RUN && data[i + run] == data[i]) run++;
+
+        if (run >= RLE_MIN_RUN) {
+            out[o++] = 0x80 | (run - RLE_MIN_RUN);
+            out[o++] = data[i];
+            i += run;
+            continue;
+        }
+
+        // Literais até o início da próxima repetição ou até o limite do bloco
+        int start = i;
+        while (i < length && i - start < RLE_MAX_LITERAL) {
+            if (i + 2 < length && data[i] == data[i + 1] && data[i] == data[i + 2]) break;
+            i++;
+        }
+        out[o++] = (uint8_t)(i - start - 1);
+        memcpy(&out[o], &data[start], i - start);
+        o += i - start;
+    }
+
+    return o;
+}
+
+/**
+ * @brief Inicializa o estado do espelhamento.
+ */
+void fb_mirror_init(void) {
+    memset(last_frame, 0, sizeof(last_frame));
+    packet_length = 0;
+    packet_sent = 0;
+    sequence = 0;
+    frame_count = 0;
+    need_keyframe = true;
+}
+
+/**
+ * @brief Submete um quadro renderizado para envio ao host.
+ * @param frame Ponteiro para o buffer do display.
+ */
+void fb_mirror_submit(const uint8_t *frame) {
+    if (!stdio_usb_connected()) {
+        packet_length = packet_sent = 0;
+        need_keyframe = true;
+        return;
+    }
+    if (packet_sent < packet_length) return;
+
+    bool keyframe = need_keyframe || (frame_count % FB_MIRROR_KEYFRAME_INTERVAL == 0);
+    frame_count++;
+    if (keyframe) memset(last_frame, 0, sizeof(last_frame));
+
+    // last_frame passa a conter o delta XOR até ser substituído pelo quadro atual
+    for (int i = 0; i < ssd1306_buffer_length; i++) last_frame[i] ^= frame[i];
+
+    int payload_length = rle_encode(last_frame, ssd1306_buffer_length, &packet[HEADER_LENGTH]);
+    memcpy(last_frame, frame, sizeof(last_frame));
+
+    uint8_t checksum = 0;
+    for (int i = 0; i < payload_length; i++) checksum += packet[HEADER_LENGTH + i];
+
+    packet[0] = FB_MIRROR_MAGIC_0;
+    packet[1] = FB_MIRROR_MAGIC_1;
+    packet[2] = keyframe ? 'K' : 'D';
+    packet[3] = sequence++;
+    packet[4] = payload_length & 0xFF;
+    packet[5] = payload_length >> 8;
+    packet[HEADER_LENGTH + payload_length] = checksum;
+
+    packet_length = HEADER_LENGTH + payload_length + 1;
+    packet_sent = 0;
+    need_keyframe = false;
+
+    fb_mirror_poll();
+}
+
+/**
+ * @brief Envia a parte do pacote pendente que cabe no buffer do USB.
+ */
+void fb_mirror_poll(void) {
+    if (packet_sent >= packet_length) return;
+
+    if (!stdio_usb_connected()) {
+        packet_length = packet_sent = 0;
+        need_keyframe = true;
+        return;
+    }
+
+    // Só escreve o que cabe no FIFO de transmissão, para nunca bloquear
+    int available = (int)tud_cdc_write_available();
+    int n = packet_length - packet_sent;
+    if (n > available) n = available;
+    if (n <= 0) return;
+
+    stdio_usb.out_chars((const char *)&packet[packet_sent], n);
+    packet_sent += n;
+}
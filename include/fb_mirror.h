@@ -0,0 +1,51 @@
+/**
+ * @file fb_mirror.h
+ * @brief Espelhamento do framebuffer do display para o host via USB CDC.
+ *
+ * Cada quadro é enviado como delta XOR em relação ao último quadro enviado,
+ * comprimido por run-length. Formato de cada pacote:
+ *
+ *   | 0xA5 | 0x5A | tipo | seq | len (u16 LE) | payload (len bytes) | soma |
+ *
+ * - tipo: 'K' (quadro-chave, delta contra um quadro zerado) ou 'D' (delta).
+ * - seq: contador de pacotes de 8 bits.
+ * - soma: soma de 8 bits dos bytes do payload.
+ *
+ * Payload RLE: um byte de controle c seguido de dados.
+ * - c < 0x80: (c + 1) bytes literais seguem.
+ * - c >= 0x80: o próximo byte se repete (c - 0x80 + 3) vezes.
+ */
+
+#ifndef FB_MIRROR_H
+#define FB_MIRROR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define FB_MIRROR_MAGIC_0 0xA5
+#define FB_MIRROR_MAGIC_1 0x5A
+#define FB_MIRROR_KEYFRAME_INTERVAL 120
+
+/**
+ * @brief Inicializa o estado do espelhamento.
+ */
+void fb_mirror_init(void);
+
+/**
+ * @brief Submete um quadro renderizado para envio ao host.
+ *
+ * Nunca bloqueia: se o pacote anterior ainda não foi totalmente enviado, o
+ * quadro é descartado e o próximo delta é calculado contra o último quadro
+ * efetivamente codificado.
+ * @param frame Buffer do display (ssd1306_buffer_length bytes)
+ */
+void fb_mirror_submit(const uint8_t *frame);
+
+/**
+ * @brief Envia ao USB a parte do pacote pendente que cabe no buffer de saída.
+ *
+ * Deve ser chamada com frequência no laço principal.
+ */
+void fb_mirror_poll(void);
+
+#endif // FB_MIRROR_H
@@ -7,6 +7,18 @@
 #include "ssd1306.h"
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
+#include <math.h>
+
+// Núcleos vetoriais só existem nos builds de host x86 (tools/host)
+#if defined(__GNUC__) && defined(__SSE2__) && (defined(__x86_64__) || defined(__i386__))
+#define GALTON_X86_KERNELS 1
+#include <immintrin.h>
+#define BALL_LANES 8
+#else
+#define GALTON_X86_KERNELS 0
+#define BALL_LANES 1
+#endif
 
 #define BALL_SIZE 2
 #define GRAVITY 0.07f
@@ -14,15 +26,57 @@
 #define INITIAL_Y_POS 5
 #define HISTOGRAM_HEIGHT 20
 #define PIN_SPACING ((ssd1306_height - INITIAL_Y_POS - 6) / NUM_PIN_ROWS - 2)
+#define SPAWN_INTERVAL 5
+#define MAX_RUN_TICKS 64
+#define PIN_Y(row) (INITIAL_Y_POS + 8 + ((row) * PIN_SPACING))
+#define PAGE_HEIGHT ((int)ssd1306_page_height)
+#define BALL_SLOTS (((MAX_BALLS + BALL_LANES - 1) / BALL_LANES) * BALL_LANES)
+#define BALL_DEFLECT 0x01
+#define BALL_LAND 0x02
 
+/**
+ * @brief Estado das bolas do motor por ticks, um vetor por campo.
+ *
+ * O laço de integração percorre cada campo de forma contígua; nos builds
+ * de host os vetores são completados até BALL_SLOTS para os núcleos SSE2 e
+ * AVX2 processarem lotes inteiros. As posições extras nunca ficam ativas.
+ */
 typedef struct {
-    float x, y;
-    float vx, vy;
+    _Alignas(32) float x[BALL_SLOTS];
+    _Alignas(32) float y[BALL_SLOTS];
+    _Alignas(32) float vx[BALL_SLOTS];
+    _Alignas(32) float vy[BALL_SLOTS];
+    bool active[BALL_SLOTS];
+    int spawn_tick[BALL_SLOTS];
+} ball_state_t;
+
+/**
+ * @brief Estado de uma bola no motor orientado a eventos.
+ *
+ * Entre dois eventos o movimento é fechado: a posição em qualquer tick é
+ * obtida a partir do estado no último evento (t0, x0, y0, vx, vy0). Uma
+ * travessia da faixa de pinos é um único evento; as direções sorteadas a
+ * cada tick dela ficam em run_dirs para o desenho dos ticks intermediários.
+ */
+typedef struct {
+    float x0, y0;
+    float vx, vy0;
+    int t0;
+    int next_row;
+    int event_tick;
+    float run_x;       // Posição horizontal no primeiro tick da travessia
+    int run_start;     // Primeiro tick da travessia
+    int run_length;    // Ticks na travessia (0 se não houver)
+    uint64_t run_dirs; // Bit k: direção sorteada no tick run_start + k
     bool active;
-    int spawn_tick;
-} ball_t;
+} event_ball_t;
 
-ball_t balls[MAX_BALLS];
+ball_state_t balls;
+static uint8_t ball_events[BALL_SLOTS];
+static event_ball_t event_balls[MAX_BALLS];
+static int event_heap[MAX_BALLS];
+static int event_heap_size = 0;
+static int next_spawn_tick = SPAWN_INTERVAL;
 int total_balls = 0;
 int current_tick = 0;
 int bins[NUM_BINS] = {0};
@@ -38,107 +92,600 @@ static bool random_direction(void) {
 
 /**
  * @brief Inicializa uma bola com posição e velocidade iniciais.
- * @param ball Ponteiro para a estrutura da bola a ser inicializada.
+ * @param i Índice da bola a ser inicializada.
  */
-static void init_ball(ball_t *ball) {
-    ball->x = ssd1306_width / 2 + (rand() % 5) - 2;
-    ball->y = INITIAL_Y_POS;
-    ball->vx = 0;
-    ball->vy = 0.1f;
-    ball->active = true;
-    ball->spawn_tick = current_tick;
+static void init_ball(int i) {
+    balls.x[i] = ssd1306_width / 2 + (rand() % 5) - 2;
+    balls.y[i] = INITIAL_Y_POS;
+    balls.vx[i] = 0;
+    balls.vy[i] = 0.1f;
+    balls.active[i] = true;
+    balls.spawn_tick[i] = current_tick;
 }
 
 /**
- * @brief Desenha uma bola no buffer do display.
- * @param buffer Ponteiro para o buffer do display.
- * @param ball Ponteiro para a bola a ser desenhada.
+ * @brief Obtém as linhas do display cobertas por uma faixa de desenho.
+ * @param page Página do SSD1306 ou GALTON_FULL_FRAME.
+ * @param y_min Saída com a primeira linha da faixa.
+ * @param y_max Saída com a última linha da faixa.
  */
-static void draw_ball(uint8_t *buffer, ball_t *ball) {
-    if (!ball->active) return;
+static void band_rows(int page, int *y_min, int *y_max) {
+    if (page == GALTON_FULL_FRAME) {
+        *y_min = 0;
+        *y_max = ssd1306_height - 1;
+    } else {
+        *y_min = page * PAGE_HEIGHT;
+        *y_max = *y_min + PAGE_HEIGHT - 1;
+    }
+}
 
+/**
+ * @brief Acende um pixel no buffer do quadro ou da página.
+ *
+ * Com GALTON_FULL_FRAME o buffer é o quadro inteiro; caso contrário é o
+ * buffer de uma única página e pixels fora dela são ignorados.
+ * @param buffer Ponteiro para o buffer do display ou da página.
+ * @param page Página do SSD1306 ou GALTON_FULL_FRAME.
+ * @param x Posição horizontal do pixel.
+ * @param y Posição vertical do pixel (coordenada do display).
+ */
+static void plot(uint8_t *buffer, int page, int x, int y) {
+    if (page == GALTON_FULL_FRAME) {
+        ssd1306_set_pixel(buffer, x, y, true);
+    } else if (y / PAGE_HEIGHT == page) {
+        buffer[x] |= 1 << (y % PAGE_HEIGHT);
+    }
+}
+
+/**
+ * @brief Desenha uma bola em uma posição arbitrária do buffer.
+ * @param buffer Ponteiro para o buffer do display ou da página.
+ * @param page Página do SSD1306 ou GALTON_FULL_FRAME.
+ * @param x Posição horizontal da bola.
+ * @param y Posição vertical da bola.
+ */
+static void draw_ball_at(uint8_t *buffer, int page, float x, float y) {
     for (int i = 0; i < BALL_SIZE; i++) {
         for (int j = 0; j < BALL_SIZE; j++) {
-            int px = (int)ball->x + i;
-            int py = (int)ball->y + j;
+            int px = (int)x + i;
+            int py = (int)y + j;
             if (px >= 0 && px < ssd1306_width && py >= 0 && py < ssd1306_height) {
-                ssd1306_set_pixel(buffer, px, py, true);
+                plot(buffer, page, px, py);
             }
         }
     }
 }
 
+/**
+ * @brief Desenha uma bola no buffer do display.
+ * @param buffer Ponteiro para o buffer do display ou da página.
+ * @param page Página do SSD1306 ou GALTON_FULL_FRAME.
+ * @param i Índice da bola a ser desenhada.
+ */
+static void draw_ball(uint8_t *buffer, int page, int i) {
+    if (!balls.active[i]) return;
+    draw_ball_at(buffer, page, balls.x[i], balls.y[i]);
+}
+
 /**
  * @brief Cria uma nova bola na simulação.
  */
 static void spawn_ball(void) {
     total_balls++;
     for (int i = 0; i < MAX_BALLS; i++) {
-        if (!balls[i].active) {
-            init_ball(&balls[i]);
+        if (!balls.active[i]) {
+            init_ball(i);
             break;
         }
     }
 }
 
 /**
- * @brief Atualiza o estado da simulação da Galton Board.
- * @param buffer Ponteiro para o buffer do display.
+ * @brief Aplica gravidade, integra as posições, limita às paredes e marca
+ * em ball_events as bolas que estão em uma janela de pino ou pousaram.
  */
-void galton_board_update(uint8_t *buffer) {
-    if (current_tick % 5 == 0) spawn_ball();
+static void integrate_balls_scalar(void) {
+    const float max_x = ssd1306_width - BALL_SIZE;
+    const float floor_y = ssd1306_height - BALL_SIZE;
 
     for (int i = 0; i < MAX_BALLS; i++) {
-        ball_t *ball = &balls[i];
-        if (!ball->active) continue;
+        ball_events[i] = 0;
+        if (!balls.active[i]) continue;
 
-        ball->vy += GRAVITY;
-        ball->x += ball->vx;
-        ball->y += ball->vy;
+        balls.vy[i] += GRAVITY;
+        balls.x[i] += balls.vx[i];
+        balls.y[i] += balls.vy[i];
+
+        if (balls.x[i] < 0) balls.x[i] = 0;
+        if (balls.x[i] > max_x) balls.x[i] = max_x;
 
         for (int row = 1; row <= NUM_PIN_ROWS; row++) {
-            int pin_y = INITIAL_Y_POS + 8 + (row * PIN_SPACING);
-            if (ball->y >= pin_y - 2 && ball->y <= pin_y + 2 && ball->vy > 0) {
-                ball->vx = random_direction() ? 2.5f : -2.5f;
+            int pin_y = PIN_Y(row);
+            if (balls.y[i] >= pin_y - 2 && balls.y[i] <= pin_y + 2 && balls.vy[i] > 0) {
+                ball_events[i] |= BALL_DEFLECT;
                 break;
             }
         }
+        if (balls.y[i] >= floor_y) ball_events[i] |= BALL_LAND;
+    }
+}
 
-        if (ball->x < 0) ball->x = 0;
-        if (ball->x > ssd1306_width - BALL_SIZE) ball->x = ssd1306_width - BALL_SIZE;
+#if GALTON_X86_KERNELS
+/**
+ * @brief Versão SSE2 de integrate_balls_scalar, 4 bolas por instrução.
+ *
+ * As operações são as mesmas do caminho escalar, com os mesmos resultados
+ * em ponto flutuante. Posições inativas também são integradas, o que é
+ * inofensivo porque init_ball as reescreve e o passo ignora seus eventos.
+ */
+static void integrate_balls_sse2(void) {
+    const __m128 gravity = _mm_set1_ps(GRAVITY);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 max_x = _mm_set1_ps(ssd1306_width - BALL_SIZE);
+    const __m128 floor_y = _mm_set1_ps(ssd1306_height - BALL_SIZE);
+
+    for (int i = 0; i < BALL_SLOTS; i += 4) {
+        __m128 vy = _mm_add_ps(_mm_load_ps(&balls.vy[i]), gravity);
+        __m128 x = _mm_add_ps(_mm_load_ps(&balls.x[i]), _mm_load_ps(&balls.vx[i]));
+        __m128 y = _mm_add_ps(_mm_load_ps(&balls.y[i]), vy);
+        x = _mm_min_ps(_mm_max_ps(x, zero), max_x);
 
-        if (ball->y >= ssd1306_height - BALL_SIZE) {
-            int bin = (int)(ball->x / BIN_WIDTH);
+        __m128 in_pin = zero;
+        for (int row = 1; row <= NUM_PIN_ROWS; row++) {
+            __m128 ge = _mm_cmpge_ps(y, _mm_set1_ps(PIN_Y(row) - 2));
+            __m128 le = _mm_cmple_ps(y, _mm_set1_ps(PIN_Y(row) + 2));
+            in_pin = _mm_or_ps(in_pin, _mm_and_ps(ge, le));
+        }
+        in_pin = _mm_and_ps(in_pin, _mm_cmpgt_ps(vy, zero));
+        int deflect = _mm_movemask_ps(in_pin);
+        int land = _mm_movemask_ps(_mm_cmpge_ps(y, floor_y));
+
+        _mm_store_ps(&balls.vy[i], vy);
+        _mm_store_ps(&balls.x[i], x);
+        _mm_store_ps(&balls.y[i], y);
+        for (int l = 0; l < 4; l++) {
+            ball_events[i + l] = ((deflect >> l) & 1) * BALL_DEFLECT | ((land >> l) & 1) * BALL_LAND;
+        }
+    }
+}
+
+/**
+ * @brief Versão AVX2 de integrate_balls_scalar, 8 bolas por instrução.
+ */
+__attribute__((target("avx2")))
+static void integrate_balls_avx2(void) {
+    const __m256 gravity = _mm256_set1_ps(GRAVITY);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 max_x = _mm256_set1_ps(ssd1306_width - BALL_SIZE);
+    const __m256 floor_y = _mm256_set1_ps(ssd1306_height - BALL_SIZE);
+
+    for (int i = 0; i < BALL_SLOTS; i += 8) {
+        __m256 vy = _mm256_add_ps(_mm256_load_ps(&balls.vy[i]), gravity);
+        __m256 x = _mm256_add_ps(_mm256_load_ps(&balls.x[i]), _mm256_load_ps(&balls.vx[i]));
+        __m256 y = _mm256_add_ps(_mm256_load_ps(&balls.y[i]), vy);
+        x = _mm256_min_ps(_mm256_max_ps(x, zero), max_x);
+
+        __m256 in_pin = zero;
+        for (int row = 1; row <= NUM_PIN_ROWS; row++) {
+            __m256 ge = _mm256_cmp_ps(y, _mm256_set1_ps(PIN_Y(row) - 2), _CMP_GE_OQ);
+            __m256 le = _mm256_cmp_ps(y, _mm256_set1_ps(PIN_Y(row) + 2), _CMP_LE_OQ);
+            in_pin = _mm256_or_ps(in_pin, _mm256_and_ps(ge, le));
+        }
+        in_pin = _mm256_and_ps(in_pin, _mm256_cmp_ps(vy, zero, _CMP_GT_OQ));
+        int deflect = _mm256_movemask_ps(in_pin);
+        int land = _mm256_movemask_ps(_mm256_cmp_ps(y, floor_y, _CMP_GE_OQ));
+
+        _mm256_store_ps(&balls.vy[i], vy);
+        _mm256_store_ps(&balls.x[i], x);
+        _mm256_store_ps(&balls.y[i], y);
+        for (int l = 0; l < 8; l++) {
+            ball_events[i + l] = ((deflect >> l) & 1) * BALL_DEFLECT | ((land >> l) & 1) * BALL_LAND;
+        }
+    }
+}
+
+static void (*integrate_balls)(void) = NULL;
+#else
+#define integrate_balls integrate_balls_scalar
+#endif
+
+/**
+ * @brief Seleciona o núcleo de integração do motor por ticks.
+ * @param kernel Núcleo desejado.
+ * @return true se o núcleo está disponível neste build e nesta CPU.
+ */
+bool galton_board_set_kernel(galton_kernel_t kernel) {
+#if GALTON_X86_KERNELS
+    __builtin_cpu_init();
+    bool has_avx2 = __builtin_cpu_supports("avx2");
+
+    switch (kernel) {
+        case GALTON_KERNEL_AUTO:
+            integrate_balls = has_avx2 ? integrate_balls_avx2 : integrate_balls_sse2;
+            return true;
+        case GALTON_KERNEL_SCALAR:
+            integrate_balls = integrate_balls_scalar;
+            return true;
+        case GALTON_KERNEL_SSE2:
+            integrate_balls = integrate_balls_sse2;
+            return true;
+        case GALTON_KERNEL_AVX2:
+            if (!has_avx2) return false;
+            integrate_balls = integrate_balls_avx2;
+            return true;
+    }
+    return false;
+#else
+    return kernel == GALTON_KERNEL_AUTO || kernel == GALTON_KERNEL_SCALAR;
+#endif
+}
+
+/**
+ * @brief Executa um passo de física da simulação, sem desenhar.
+ *
+ * A integração não consome números aleatórios, então é feita antes para
+ * todas as bolas; as deflexões e pousos seguem na ordem das bolas, o que
+ * mantém a mesma sequência de rand() de uma atualização bola a bola e os
+ * compartimentos idênticos entre os núcleos escalar, SSE2 e AVX2.
+ */
+void galton_board_step(void) {
+    if (current_tick % SPAWN_INTERVAL == 0) spawn_ball();
+
+#if GALTON_X86_KERNELS
+    if (!integrate_balls) galton_board_set_kernel(GALTON_KERNEL_AUTO);
+#endif
+    integrate_balls();
+
+    for (int i = 0; i < MAX_BALLS; i++) {
+        if (!balls.active[i] || !ball_events[i]) continue;
+
+        if (ball_events[i] & BALL_DEFLECT) {
+            balls.vx[i] = random_direction() ? 2.5f : -2.5f;
+        }
+
+        if (ball_events[i] & BALL_LAND) {
+            int bin = (int)(balls.x[i] / BIN_WIDTH);
             if (bin >= 0 && bin < NUM_BINS) bins[bin]++;
-            init_ball(ball);
+            init_ball(i);
         }
+    }
+}
 
-        draw_ball(buffer, ball);
+/**
+ * @brief Desenha as bolas do motor por ticks no buffer.
+ * @param buffer Ponteiro para o buffer do display ou da página.
+ * @param page Página do SSD1306 ou GALTON_FULL_FRAME.
+ */
+void galton_board_draw_balls(uint8_t *buffer, int page) {
+    for (int i = 0; i < MAX_BALLS; i++) {
+        draw_ball(buffer, page, i);
+    }
+}
+
+/**
+ * @brief Distância vertical percorrida após um número de ticks.
+ *
+ * Reproduz de forma fechada a integração do motor por ticks, em que a
+ * gravidade é somada à velocidade antes de cada passo de posição.
+ * @param vy0 Velocidade vertical no início do intervalo.
+ * @param dt Número de ticks decorridos.
+ * @return Deslocamento vertical acumulado.
+ */
+static float fall_distance(float vy0, int dt) {
+    return dt * vy0 + GRAVITY * 0.5f * (float)dt * (float)(dt + 1);
+}
+
+/**
+ * @brief Calcula em quantos ticks a bola atinge uma altura alvo.
+ * @param y0 Altura no início do intervalo.
+ * @param vy0 Velocidade vertical no início do intervalo.
+ * @param target_y Altura a ser atingida.
+ * @return Menor número de ticks (>= 1) em que y >= target_y.
+ */
+static int ticks_until_y(float y0, float vy0, float target_y) {
+    float dist = target_y - y0;
+    if (dist <= 0) return 1;
+
+    // Raiz de (G/2)dt² + (vy0 + G/2)dt - dist = 0
+    float a = GRAVITY * 0.5f;
+    float b = vy0 + GRAVITY * 0.5f;
+    int dt = (int)ceilf((-b + sqrtf(b * b + 4.0f * a * dist)) / (2.0f * a));
+    if (dt < 1) dt = 1;
+
+    // Corrige arredondamentos de ponto flutuante
+    while (dt > 1 && fall_distance(vy0, dt - 1) >= dist) dt--;
+    while (fall_distance(vy0, dt) < dist) dt++;
+    return dt;
+}
+
+/**
+ * @brief Calcula em quantos ticks a bola passa a estar abaixo de uma altura.
+ * @param y0 Altura no início do intervalo.
+ * @param vy0 Velocidade vertical no início do intervalo.
+ * @param limit_y Altura a ser ultrapassada.
+ * @return Menor número de ticks (>= 1) em que y > limit_y.
+ */
+static int ticks_until_past(float y0, float vy0, float limit_y) {
+    int dt = ticks_until_y(y0, vy0, limit_y);
+    while (y0 + fall_distance(vy0, dt) <= limit_y) dt++;
+    return dt;
+}
+
+/**
+ * @brief Limita a posição horizontal às paredes do display.
+ * @param x Posição horizontal.
+ * @return Posição limitada.
+ */
+static float clamp_x(float x) {
+    if (x < 0) return 0;
+    if (x > ssd1306_width - BALL_SIZE) return ssd1306_width - BALL_SIZE;
+    return x;
+}
+
+/**
+ * @brief Calcula a posição de uma bola do motor de eventos em um tick.
+ * @param ball Ponteiro para a bola.
+ * @param tick Tick em que a posição é avaliada.
+ * @param x Saída com a posição horizontal (já limitada às paredes).
+ * @param y Saída com a posição vertical.
+ */
+static void event_ball_position(const event_ball_t *ball, int tick, float *x, float *y) {
+    int dt = tick - ball->t0;
+
+    // A forma fechada de y também vale para dt negativo (dentro da travessia)
+    *y = ball->y0 + fall_distance(ball->vy0, dt);
+
+    if (ball->run_length > 0 && tick >= ball->run_start && tick < ball->t0) {
+        float px = ball->run_x;
+        for (int k = 0; k < tick - ball->run_start; k++) {
+            px = clamp_x(px + (((ball->run_dirs >> k) & 1) ? 2.5f : -2.5f));
+        }
+        *x = px;
+        return;
+    }
+
+    // Com vx constante, limitar a reta equivale a limitar a cada tick
+    *x = clamp_x(ball->x0 + ball->vx * dt);
+}
+
+/**
+ * @brief Troca duas entradas do heap de eventos.
+ * @param a Índice da primeira entrada.
+ * @param b Índice da segunda entrada.
+ */
+static void heap_swap(int a, int b) {
+    int tmp = event_heap[a];
+    event_heap[a] = event_heap[b];
+    event_heap[b] = tmp;
+}
+
+/**
+ * @brief Insere uma bola no heap mínimo ordenado pelo tick do próximo evento.
+ * @param index Índice da bola em event_balls.
+ */
+static void heap_push(int index) {
+    int i = event_heap_size++;
+    event_heap[i] = index;
+
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (event_balls[event_heap[parent]].event_tick <= event_balls[event_heap[i]].event_tick) break;
+        heap_swap(i, parent);
+        i = parent;
+    }
+}
+
+/**
+ * @brief Remove a bola com o evento mais próximo do heap.
+ * @return Índice da bola removida.
+ */
+static int heap_pop(void) {
+    int top = event_heap[0];
+    event_heap[0] = event_heap[--event_heap_size];
+
+    int i = 0;
+    while (true) {
+        int left = 2 * i + 1;
+        int right = left + 1;
+        int smallest = i;
+        if (left < event_heap_size &&
+            event_balls[event_heap[left]].event_tick < event_balls[event_heap[smallest]].event_tick) smallest = left;
+        if (right < event_heap_size &&
+            event_balls[event_heap[right]].event_tick < event_balls[event_heap[smallest]].event_tick) smallest = right;
+        if (smallest == i) break;
+        heap_swap(i, smallest);
+        i = smallest;
+    }
+    return top;
+}
+
+/**
+ * @brief Agenda o próximo evento de uma bola (deflexão ou pouso).
+ *
+ * O evento de deflexão é o primeiro tick em que a bola está dentro da janela
+ * de colisão (pin_y ± 2) da próxima fileira, como no motor por ticks; ele
+ * cobre toda a travessia das janelas contíguas a partir dessa fileira.
+ * @param index Índice da bola em event_balls.
+ */
+static void schedule_event(int index) {
+    event_ball_t *ball = &event_balls[index];
+
+    while (ball->next_row <= NUM_PIN_ROWS) {
+        int pin_y = PIN_Y(ball->next_row);
+        int dt = ticks_until_y(ball->y0, ball->vy0, pin_y - 2);
+
+        if (ball->y0 + fall_distance(ball->vy0, dt) <= pin_y + 2) {
+            ball->event_tick = ball->t0 + dt;
+            heap_push(index);
+            return;
+        }
+        ball->next_row++;
+    }
+
+    ball->event_tick = ball->t0 + ticks_until_y(ball->y0, ball->vy0, ssd1306_height - BALL_SIZE);
+    heap_push(index);
+}
+
+/**
+ * @brief Inicializa uma bola do motor de eventos e agenda seu primeiro evento.
+ * @param index Índice da bola em event_balls.
+ * @param tick Tick correspondente à posição inicial.
+ */
+static void init_event_ball(int index, int tick) {
+    event_ball_t *ball = &event_balls[index];
+    ball->x0 = ssd1306_width / 2 + (rand() % 5) - 2;
+    ball->y0 = INITIAL_Y_POS;
+    ball->vx = 0;
+    ball->vy0 = 0.1f;
+    ball->t0 = tick;
+    ball->next_row = 1;
+    ball->run_length = 0;
+    ball->active = true;
+    schedule_event(index);
+}
+
+/**
+ * @brief Cria uma nova bola no motor de eventos.
+ * @param tick Tick de lançamento.
+ */
+static void spawn_event_ball(int tick) {
+    total_balls++;
+    for (int i = 0; i < MAX_BALLS; i++) {
+        if (!event_balls[i].active) {
+            // No motor por ticks a bola lançada já é integrada no mesmo tick
+            init_event_ball(i, tick - 1);
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Processa o evento pendente de uma bola.
+ *
+ * Ao entrar em uma janela de pinos a bola atravessa, em um único evento,
+ * todas as janelas contíguas: como no motor por ticks ela recebe uma nova
+ * direção aleatória a cada tick dentro delas, e a posição horizontal é
+ * avançada e limitada às paredes tick a tick. O número de ticks da
+ * travessia vem da forma fechada de y. Ao atingir o fundo a bola é
+ * contabilizada no compartimento e relançada.
+ * @param index Índice da bola em event_balls.
+ */
+static void process_event(int index) {
+    event_ball_t *ball = &event_balls[index];
+    int tick = ball->event_tick;
+    float x, y;
+    event_ball_position(ball, tick, &x, &y);
+
+    if (ball->next_row > NUM_PIN_ROWS) {
+        int bin = (int)(x / BIN_WIDTH);
+        if (bin >= 0 && bin < NUM_BINS) bins[bin]++;
+        init_event_ball(index, tick);
+        return;
+    }
+
+    float vy = ball->vy0 + GRAVITY * (tick - ball->t0);
+
+    // Janelas que se tocam formam uma faixa atravessada sem interrupção
+    int last_row = ball->next_row;
+    while (last_row < NUM_PIN_ROWS && PIN_Y(last_row + 1) - 2 <= PIN_Y(last_row) + 2) last_row++;
+
+    int run = ticks_until_past(y, vy, PIN_Y(last_row) + 2);
+    bool truncated = run > MAX_RUN_TICKS;
+    if (truncated) run = MAX_RUN_TICKS;
+
+    uint64_t dirs = 0;
+    float px = x;
+    float vx = ball->vx;
+    for (int k = 0; k < run; k++) {
+        if (k > 0) px = clamp_x(px + vx);
+        bool right = random_direction();
+        if (right) dirs |= (uint64_t)1 << k;
+        vx = right ? 2.5f : -2.5f;
+    }
+
+    ball->run_x = x;
+    ball->run_start = tick;
+    ball->run_length = run;
+    ball->run_dirs = dirs;
+
+    ball->t0 = tick + run - 1;
+    ball->x0 = px;
+    ball->y0 = y + fall_distance(vy, run - 1);
+    ball->vy0 = vy + GRAVITY * (run - 1);
+    ball->vx = vx;
+    // Travessia truncada: schedule_event reencontra a fileira atual
+    if (!truncated) ball->next_row = last_row + 1;
+    schedule_event(index);
+}
+
+/**
+ * @brief Avança o motor de eventos até um tick alvo.
+ * @param target_tick Tick até o qual a simulação deve avançar.
+ */
+void galton_board_advance_to(int target_tick) {
+    while (true) {
+        int next_event = event_heap_size ? event_balls[event_heap[0]].event_tick : INT_MAX;
+
+        if (next_spawn_tick <= next_event) {
+            if (next_spawn_tick > target_tick) break;
+            spawn_event_ball(next_spawn_tick);
+            next_spawn_tick += SPAWN_INTERVAL;
+        } else {
+            if (next_event > target_tick) break;
+            process_event(heap_pop());
+        }
+    }
+
+    if (target_tick > current_tick) current_tick = target_tick;
+}
+
+/**
+ * @brief Desenha as bolas do motor de eventos na posição do tick atual.
+ * @param buffer Ponteiro para o buffer do display ou da página.
+ * @param page Página do SSD1306 ou GALTON_FULL_FRAME.
+ */
+void galton_board_draw_event_balls(uint8_t *buffer, int page) {
+    for (int i = 0; i < MAX_BALLS; i++) {
+        if (!event_balls[i].active) continue;
+
+        float x, y;
+        event_ball_position(&event_balls[i], current_tick, &x, &y);
+        draw_ball_at(buffer, page, x, y);
     }
 }
 
 /**
  * @brief Desenha os pinos da Galton Board no buffer.
- * @param buffer Ponteiro para o buffer do display.
+ * @param buffer Ponteiro para o buffer do display ou da página.
+ * @param page Página do SSD1306 ou GALTON_FULL_FRAME.
  */
-void galton_board_draw_pins(uint8_t *buffer) {
+void galton_board_draw_pins(uint8_t *buffer, int page) {
+    int y_min, y_max;
+    band_rows(page, &y_min, &y_max);
+
     for (int row = 1; row <= NUM_PIN_ROWS; row++) {
-        int y = INITIAL_Y_POS + 8 + (row * PIN_SPACING);
+        int y = PIN_Y(row);
+        if (y + 1 < y_min || y > y_max) continue;
+
         int start_x = (row % 2) ? BIN_WIDTH / 2 : 0;
         for (int x = start_x; x < ssd1306_width; x += BIN_WIDTH) {
-            ssd1306_set_pixel(buffer, x, y, true);
-            ssd1306_set_pixel(buffer, x + 1, y, true);
-            ssd1306_set_pixel(buffer, x, y + 1, true);
-            ssd1306_set_pixel(buffer, x + 1, y + 1, true);
+            plot(buffer, page, x, y);
+            plot(buffer, page, x + 1, y);
+            plot(buffer, page, x, y + 1);
+            plot(buffer, page, x + 1, y + 1);
         }
     }
 }
 
 /**
  * @brief Desenha o histograma de distribuição das bolas.
- * @param buffer Ponteiro para o buffer do display.
+ * @param buffer Ponteiro para o buffer do display ou da página.
+ * @param page Página do SSD1306 ou GALTON_FULL_FRAME.
  */
-void galton_board_draw_histogram(uint8_t *buffer) {
+void galton_board_draw_histogram(uint8_t *buffer, int page) {
+    int y_min, y_max;
+    band_rows(page, &y_min, &y_max);
+
     int max_count = 1;
     for (int i = 0; i < NUM_BINS; i++) if (bins[i] > max_count) max_count = bins[i];
 
@@ -148,10 +695,12 @@ void galton_board_draw_histogram(uint8_t *buffer) {
         int x_end = x_start + BIN_WIDTH - 1;
         int y_start = ssd1306_height - 1;
         int y_end = y_start - bar_height;
+        if (y_start > y_max) y_start = y_max;
+        if (y_end < y_min) y_end = y_min;
 
         for (int y = y_start; y >= y_end; y--) {
             for (int x = x_start; x <= x_end; x++) {
-                ssd1306_set_pixel(buffer, x, y, true);
+                plot(buffer, page, x, y);
             }
         }
     }
@@ -161,6 +710,10 @@ void galton_board_draw_histogram(uint8_t *buffer) {
  * @brief Inicializa a simulação da Galton Board.
  */
 void galton_board_init(void) {
-    for (int i = 0; i < MAX_BALLS; i++) balls[i].active = false;
+    memset(&balls, 0, sizeof(balls));
+    for (int i = 0; i < MAX_BALLS; i++) event_balls[i].active = false;
     memset(bins, 0, sizeof(bins));
+
+    event_heap_size = 0;
+    next_spawn_tick = current_tick - (current_tick % SPAWN_INTERVAL) + SPAWN_INTERVAL;
 }
\ No newline at end of file
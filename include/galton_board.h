@@ -12,6 +12,7 @@
 #define MAX_BALLS 30
 #define NUM_BINS 16
 #define NUM_PIN_ROWS 8
+#define GALTON_FULL_FRAME (-1) // Desenha no buffer do quadro inteiro
 
 extern int total_balls;
 extern int current_tick;
@@ -24,21 +25,71 @@ extern bool show_histogram;
 void galton_board_init(void);
 
 /**
- * @brief Atualiza o estado da simulação (movimento das bolinhas).
- * @param buffer Buffer do display
+ * @brief Executa um passo de física do motor por ticks, sem desenhar.
+ *
+ * Deve ser chamada uma vez por tick de simulação, após incrementar
+ * current_tick. Permite executar vários passos por quadro renderizado.
  */
-void galton_board_update(uint8_t *buffer);
+void galton_board_step(void);
+
+/**
+ * @brief Núcleos de integração do motor por ticks.
+ *
+ * SSE2 e AVX2 só existem nos builds de host x86 (tools/host); no RP2040
+ * apenas o núcleo escalar está disponível.
+ */
+typedef enum {
+    GALTON_KERNEL_AUTO,
+    GALTON_KERNEL_SCALAR,
+    GALTON_KERNEL_SSE2,
+    GALTON_KERNEL_AVX2
+} galton_kernel_t;
+
+/**
+ * @brief Seleciona o núcleo de integração usado por galton_board_step.
+ *
+ * Por padrão (GALTON_KERNEL_AUTO) usa o mais rápido suportado pela CPU.
+ * @param kernel Núcleo desejado
+ * @return true se o núcleo está disponível neste build e nesta CPU
+ */
+bool galton_board_set_kernel(galton_kernel_t kernel);
+
+/**
+ * @brief Desenha as bolas do motor por ticks.
+ * @param buffer Buffer do display, ou da página quando page >= 0
+ * @param page Página do SSD1306 a desenhar, ou GALTON_FULL_FRAME
+ */
+void galton_board_draw_balls(uint8_t *buffer, int page);
+
+/**
+ * @brief Avança o motor orientado a eventos até o tick indicado, sem desenhar.
+ *
+ * Alternativa a galton_board_step: cada bola só é processada quando cruza
+ * uma fileira de pinos ou pousa, usando a trajetória analítica entre
+ * eventos. Permite avançar rapidamente a simulação por muitos ticks.
+ * @param target_tick Tick alvo
+ */
+void galton_board_advance_to(int target_tick);
+
+/**
+ * @brief Desenha as bolas do motor de eventos na posição do tick atual.
+ * @param buffer Buffer do display, ou da página quando page >= 0
+ * @param page Página do SSD1306 a desenhar, ou GALTON_FULL_FRAME
+ */
+void galton_board_draw_event_balls(uint8_t *buffer, int page);
 
 /**
  * @brief Desenha os pinos da Galton Board.
- * @param buffer Buffer do display
+ * @param buffer Buffer do display, ou da página quando page >= 0
+ * @param page Página do SSD1306 a desenhar, ou GALTON_FULL_FRAME
  */
-void galton_board_draw_pins(uint8_t *buffer);
+void galton_board_draw_pins(uint8_t *buffer, int page);
 
 /**
  * @brief Desenha o histograma no buffer do display.
- * @param buffer Buffer do display
+ * @param buffer Buffer do display, ou da página quando page >= 0
+ * @param page Página do SSD1306 a desenhar, ou GALTON_FULL_FRAME
  */
-void galton_board_draw_histogram(uint8_t *buffer);
+void galton_board_draw_histogram(uint8_t *buffer, int page);
 
 #endif // GALTON_BOARD_H
\ No newline at end of file
@@ -11,11 +11,27 @@
 
 #include "display.h"
 #include "galton_board.h"
+#include "fb_mirror.h"
 
 #define BUTTON_A_PIN 5
 #define I2C_SDA 14
 #define I2C_SCL 15
 #define TICK_RATE_MS 16
+#define USE_EVENT_ENGINE 0 // 1 para usar o motor orientado a eventos
+#define SIM_SPEED 1        // Fixo: ticks por quadro; adaptativo: ticks por TICK_RATE_MS de tempo real
+#define SIM_ADAPTIVE 1     // 1 para escolher os subpassos pelo tempo medido
+#define SIM_MAX_SUBSTEPS 32
+#define SIM_MIN_BUDGET_US ((TICK_RATE_MS * 1000) / 4) // Orçamento mínimo quando o quadro já estoura
+#define SIM_TICK_US ((TICK_RATE_MS * 1000) / SIM_SPEED)
+
+#if SIM_SPEED > TICK_RATE_MS * 1000
+#error "SIM_SPEED acima de TICK_RATE_MS * 1000 zera SIM_TICK_US"
+#endif
+#define FB_MIRROR 0        // 1 para espelhar o framebuffer no host via USB
+
+#if PAGED_RENDER && FB_MIRROR
+#error "FB_MIRROR requer o framebuffer completo; desative PAGED_RENDER"
+#endif
 
 /**
  * @brief Controlador de ticks temporizados.
@@ -27,6 +43,19 @@ typedef struct {
 
 static tick_controller_t tick_ctrl;
 
+/**
+ * @brief Controlador da razão entre ticks de simulação e quadros exibidos.
+ */
+typedef struct {
+    absolute_time_t last_frame_time;
+    int64_t sim_debt_us;     // Tempo de simulação devido e ainda não executado
+    uint32_t step_cost_us;   // Custo médio medido de um subpasso
+    uint32_t render_cost_us; // Último custo medido de desenho + display_render
+} sim_rate_t;
+
+static sim_rate_t sim_rate;
+static char status_text[20];
+
 /**
  * @brief Inicializa o controlador de ticks.
  * @param tc Ponteiro para a estrutura tick_controller_t.
@@ -53,6 +82,106 @@ static bool should_process_tick(tick_controller_t *tc) {
     return false;
 }
 
+/**
+ * @brief Inicializa o controlador de subpassos.
+ * @param sr Ponteiro para a estrutura sim_rate_t.
+ */
+static void init_sim_rate(sim_rate_t *sr) {
+    sr->last_frame_time = get_absolute_time();
+    sr->sim_debt_us = 0;
+    sr->step_cost_us = 1;
+    sr->render_cost_us = 0;
+}
+
+/**
+ * @brief Decide quantos ticks de simulação executar no quadro atual.
+ *
+ * No modo fixo são SIM_SPEED subpassos por quadro. No modo adaptativo o
+ * tempo real decorrido desde o último quadro vira ticks devidos, limitados
+ * pelo tempo que sobra do período alvo (TICK_RATE_MS) após o desenho e o
+ * display_render. O orçamento não depende do tempo gasto nos subpassos do
+ * quadro anterior, para que ele de fato reduza K quando o passo fica caro.
+ * @param sr Ponteiro para a estrutura sim_rate_t.
+ * @return Número de subpassos a executar.
+ */
+static int sim_substeps(sim_rate_t *sr) {
+#if SIM_ADAPTIVE
+    absolute_time_t now = get_absolute_time();
+    int64_t frame_us = absolute_time_diff_us(sr->last_frame_time, now);
+    sr->last_frame_time = now;
+
+    sr->sim_debt_us += frame_us;
+    int wanted = (int)(sr->sim_debt_us / SIM_TICK_US);
+
+    // Com o display mais lento que o período alvo ainda sobra um mínimo,
+    // para manter a velocidade real enquanto os passos forem baratos
+    int64_t budget_us = (int64_t)TICK_RATE_MS * 1000 - sr->render_cost_us;
+    if (budget_us < SIM_MIN_BUDGET_US) budget_us = SIM_MIN_BUDGET_US;
+    int affordable = (int)(budget_us / sr->step_cost_us);
+    if (affordable < 1) affordable = 1;
+
+    int k = wanted;
+    if (k > affordable) k = affordable;
+    if (k > SIM_MAX_SUBSTEPS) k = SIM_MAX_SUBSTEPS;
+
+    sr->sim_debt_us -= (int64_t)k * SIM_TICK_US;
+    // Descarta atraso que não cabe no orçamento para não acumular indefinidamente
+    if (sr->sim_debt_us > SIM_TICK_US) sr->sim_debt_us = SIM_TICK_US;
+    return k;
+#else
+    (void)sr;
+    return SIM_SPEED;
+#endif
+}
+
+/**
+ * @brief Executa os subpassos de simulação e atualiza o custo medido.
+ * @param sr Ponteiro para a estrutura sim_rate_t.
+ * @param substeps Número de ticks de simulação a executar.
+ */
+static void run_simulation(sim_rate_t *sr, int substeps) {
+    if (substeps <= 0) return;
+
+    absolute_time_t start = get_absolute_time();
+#if USE_EVENT_ENGINE
+    galton_board_advance_to(current_tick + substeps);
+#else
+    for (int i = 0; i < substeps; i++) {
+        current_tick++;
+        galton_board_step();
+    }
+#endif
+    int64_t elapsed = absolute_time_diff_us(start, get_absolute_time());
+
+    uint32_t per_step = (uint32_t)(elapsed / substeps);
+    if (per_step < 1) per_step = 1;
+    sr->step_cost_us = (3 * sr->step_cost_us + per_step) / 4;
+}
+
+/**
+ * @brief Desenha o quadro inteiro ou apenas uma página dele.
+ * @param buffer Buffer do display, ou da página quando page >= 0.
+ * @param page Página do SSD1306 ou GALTON_FULL_FRAME.
+ */
+static void draw_frame(uint8_t *buffer, int page) {
+#if USE_EVENT_ENGINE
+    galton_board_draw_event_balls(buffer, page);
+#else
+    galton_board_draw_balls(buffer, page);
+#endif
+    galton_board_draw_pins(buffer, page);
+
+    if (show_histogram) {
+        galton_board_draw_histogram(buffer, page);
+    }
+
+    if (page == GALTON_FULL_FRAME) {
+        display_draw_text(buffer, 5, 5, status_text);
+    } else {
+        display_draw_text_page(buffer, page, 5, 5, status_text);
+    }
+}
+
 /**
  * @brief Função principal da aplicação.
  * @return int Código de retorno (sempre 0).
@@ -73,33 +202,44 @@ int main() {
     display_init();
     galton_board_init();
     init_tick_controller(&tick_ctrl);
+    init_sim_rate(&sim_rate);
+#if FB_MIRROR
+    fb_mirror_init();
+#endif
 
+#if !PAGED_RENDER
     uint8_t buffer[ssd1306_buffer_length];
+#endif
 
     while (true) {
         if (should_process_tick(&tick_ctrl)) {
-            current_tick++;
-
             if (!gpio_get(BUTTON_A_PIN)) {
                 show_histogram = !show_histogram;
                 sleep_ms(200);
             }
 
-            memset(buffer, 0, sizeof(buffer));
-
-            galton_board_update(buffer);
-            galton_board_draw_pins(buffer);
+            run_simulation(&sim_rate, sim_substeps(&sim_rate));
 
-            if (show_histogram) {
-                galton_board_draw_histogram(buffer);
-            }
-
-            char text[20];
-            sprintf(text, "T:%d B:%d", current_tick, total_balls);
-            display_draw_text(buffer, 5, 5, text);
+            sprintf(status_text, "T:%d B:%d", current_tick, total_balls);
 
+            absolute_time_t render_start = get_absolute_time();
+#if PAGED_RENDER
+            display_render_paged(draw_frame);
+            display_wait_idle(); // O custo medido inclui o envio da última página
+#else
+            memset(buffer, 0, sizeof(buffer));
+            draw_frame(buffer, GALTON_FULL_FRAME);
             display_render(buffer);
+#endif
+            sim_rate.render_cost_us = (uint32_t)absolute_time_diff_us(render_start, get_absolute_time());
+
+#if FB_MIRROR
+            fb_mirror_submit(buffer);
+#endif
         }
+#if FB_MIRROR
+        fb_mirror_poll();
+#endif
         sleep_ms(1);
     }
 
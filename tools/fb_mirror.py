@@ -0,0 +1,213 @@
+#!/usr/bin/env python3
+"""
+Decodifica o espelhamento do framebuffer enviado pela placa via USB CDC.
+
+Formato dos pacotes descrito em include/fb_mirror.h. Exemplos:
+
+    python3 tools/fb_mirror.py /dev/ttyACM0 --live
+    python3 tools/fb_mirror.py /dev/ttyACM0 --png quadros/ --scale 4
+    python3 tools/fb_mirror.py captura.bin --pgm quadros/
+
+A entrada pode ser uma porta serial (usa pyserial, se instalado), um arquivo
+com uma captura bruta ou '-' para a entrada padrão.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+WIDTH = 128
+HEIGHT = 64
+FRAME_LENGTH = WIDTH * HEIGHT // 8
+MAGIC = b"\xA5\x5A"
+HEADER_LENGTH = 6
+RLE_MIN_RUN = 3
+
+
+def open_input(path):
+    """Abre a porta serial, o arquivo de captura ou a entrada padrão."""
+    if path == "-":
+        return sys.stdin.buffer
+    try:
+        import serial
+        if not os.path.isfile(path):
+            return serial.Serial(path, timeout=1)
+    except ImportError:
+        pass
+    stream = open(path, "rb", buffering=0)
+    if os.isatty(stream.fileno()):
+        # Sem pyserial: o modo canônico alteraria bytes 0x0D e bufferizaria linhas
+        import tty
+        tty.setraw(stream.fileno())
+    return stream
+
+
+def rle_decode(payload):
+    """Expande o payload RLE; retorna None se o tamanho não bater."""
+    out = bytearray()
+    i = 0
+    while i < len(payload):
+        c = payload[i]
+        i += 1
+        if c & 0x80:
+            if i >= len(payload):
+                return None
+            out += bytes([payload[i]]) * ((c & 0x7F) + RLE_MIN_RUN)
+            i += 1
+        else:
+            out += payload[i:i + c + 1]
+            i += c + 1
+    return out if len(out) == FRAME_LENGTH else None
+
+
+def read_packets(stream):
+    """Gera (tipo, seq, payload) dos pacotes válidos, ressincronizando no magic.
+
+    Sempre que bytes são descartados (lixo ou pacote corrompido) gera
+    (None, None, None), para que o decodificador invalide o quadro atual.
+    """
+    buffer = bytearray()
+    while True:
+        # Em porta serial lê só o que já chegou, para não esperar 4096 bytes
+        size = max(1, stream.in_waiting) if hasattr(stream, "in_waiting") else 4096
+        chunk = stream.read(size)
+        if not chunk:
+            # Em porta serial read() apenas expirou; em arquivo é o fim
+            if hasattr(stream, "in_waiting"):
+                continue
+            return
+        buffer += chunk
+
+        while True:
+            start = buffer.find(MAGIC)
+            if start < 0:
+                # Um único byte final pode ser o início de um magic
+                if len(buffer) > 1 or (buffer and buffer[0] != MAGIC[0]):
+                    yield None, None, None
+                del buffer[:-1]
+                break
+            if start > 0:
+                yield None, None, None
+            del buffer[:start]
+            if len(buffer) < HEADER_LENGTH:
+                break
+            kind, seq, length = buffer[2], buffer[3], struct.unpack_from("<H", buffer, 4)[0]
+            total = HEADER_LENGTH + length + 1
+            if kind not in b"KD" or length > 2 * FRAME_LENGTH:
+                del buffer[:2]
+                yield None, None, None
+                continue
+            if len(buffer) < total:
+                break
+            payload = bytes(buffer[HEADER_LENGTH:HEADER_LENGTH + length])
+            if sum(payload) & 0xFF != buffer[total - 1]:
+                del buffer[:2]
+                yield None, None, None
+                continue
+            del buffer[:total]
+            yield chr(kind), seq, payload
+
+
+def frames(stream):
+    """Gera os quadros completos reconstruídos a partir dos deltas."""
+    frame = None
+    last_seq = None
+    for kind, seq, payload in read_packets(stream):
+        # Pacote perdido: o próximo delta teria a base errada
+        expected = None if last_seq is None else (last_seq + 1) & 0xFF
+        last_seq = seq
+        if kind is None or (kind == "D" and seq != expected):
+            frame = None
+            continue
+
+        delta = rle_decode(payload)
+        if delta is None:
+            frame = None
+            continue
+        if kind == "K":
+            frame = bytearray(FRAME_LENGTH)
+        elif frame is None:
+            continue  # Aguarda o próximo quadro-chave
+        for i in range(FRAME_LENGTH):
+            frame[i] ^= delta[i]
+        yield bytes(frame)
+
+
+def to_pixels(frame):
+    """Converte o layout de páginas do SSD1306 em linhas de pixels 0/1."""
+    return [[(frame[(y // 8) * WIDTH + x] >> (y % 8)) & 1 for x in range(WIDTH)]
+            for y in range(HEIGHT)]
+
+
+def scaled_rows(pixels, scale):
+    """Gera linhas de bytes em tons de cinza ampliadas por 'scale'."""
+    for row in pixels:
+        line = bytes(255 if p else 0 for p in row for _ in range(scale))
+        for _ in range(scale):
+            yield line
+
+
+def write_pgm(path, pixels, scale):
+    with open(path, "wb") as f:
+        f.write(b"P5\n%d %d\n255\n" % (WIDTH * scale, HEIGHT * scale))
+        for line in scaled_rows(pixels, scale):
+            f.write(line)
+
+
+def write_png(path, pixels, scale):
+    def chunk(tag, data):
+        body = tag + data
+        return struct.pack(">I", len(data)) + body + struct.pack(">I", zlib.crc32(body) & 0xFFFFFFFF)
+
+    raw = b"".join(b"\x00" + line for line in scaled_rows(pixels, scale))
+    header = struct.pack(">IIBBBBB", WIDTH * scale, HEIGHT * scale, 8, 0, 0, 0, 0)
+    with open(path, "wb") as f:
+        f.write(b"\x89PNG\r\n\x1a\n")
+        f.write(chunk(b"IHDR", header))
+        f.write(chunk(b"IDAT", zlib.compress(raw)))
+        f.write(chunk(b"IEND", b""))
+
+
+def show_live(pixels):
+    """Desenha o quadro no terminal usando meio-blocos (duas linhas por caractere)."""
+    glyphs = {(0, 0): " ", (1, 0): "▀", (0, 1): "▄", (1, 1): "█"}
+    lines = ["".join(glyphs[(top[x], bottom[x])] for x in range(WIDTH))
+             for top, bottom in zip(pixels[0::2], pixels[1::2])]
+    sys.stdout.write("\x1b[H" + "\n".join(lines) + "\n")
+    sys.stdout.flush()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("input", help="porta serial, arquivo de captura ou '-'")
+    parser.add_argument("--pgm", metavar="DIR", help="salva os quadros como PGM")
+    parser.add_argument("--png", metavar="DIR", help="salva os quadros como PNG")
+    parser.add_argument("--live", action="store_true", help="exibe os quadros no terminal")
+    parser.add_argument("--scale", type=int, default=1, help="fator de ampliação das imagens")
+    args = parser.parse_args()
+
+    if not (args.pgm or args.png or args.live):
+        args.live = True
+    for directory in (args.pgm, args.png):
+        if directory:
+            os.makedirs(directory, exist_ok=True)
+    if args.live:
+        sys.stdout.write("\x1b[2J")
+
+    try:
+        for index, frame in enumerate(frames(open_input(args.input))):
+            pixels = to_pixels(frame)
+            if args.pgm:
+                write_pgm(os.path.join(args.pgm, "frame_%06d.pgm" % index), pixels, args.scale)
+            if args.png:
+                write_png(os.path.join(args.png, "frame_%06d.png" % index), pixels, args.scale)
+            if args.live:
+                show_live(pixels)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,60 @@
+/**
+ * @file galton_bench.c
+ * @brief Benchmark de host de galton_board_step por núcleo de integração.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "galton_board.h"
+
+#define DEFAULT_TICKS 5000000
+
+static const struct {
+    galton_kernel_t kernel;
+    const char *name;
+} kernels[] = {
+    {GALTON_KERNEL_SCALAR, "scalar"},
+    {GALTON_KERNEL_SSE2, "sse2"},
+    {GALTON_KERNEL_AVX2, "avx2"},
+};
+
+/**
+ * @brief Lê o relógio monotônico em segundos.
+ * @return Tempo atual em segundos.
+ */
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv) {
+    int ticks = argc > 1 ? atoi(argv[1]) : DEFAULT_TICKS;
+    double scalar_seconds = 0;
+
+    for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+        if (!galton_board_set_kernel(kernels[k].kernel)) {
+            printf("%-7s indisponível\n", kernels[k].name);
+            continue;
+        }
+
+        srand(1);
+        current_tick = 0;
+        total_balls = 0;
+        galton_board_init();
+
+        double start = now_seconds();
+        for (int t = 0; t < ticks; t++) {
+            current_tick++;
+            galton_board_step();
+        }
+        double seconds = now_seconds() - start;
+        if (kernels[k].kernel == GALTON_KERNEL_SCALAR) scalar_seconds = seconds;
+
+        printf("%-7s %8.3f s  %7.2f Mticks/s  %5.2fx\n", kernels[k].name, seconds,
+               ticks / seconds / 1e6, scalar_seconds / seconds);
+    }
+
+    return 0;
+}
@@ -0,0 +1,67 @@
+/**
+ * @file galton_bins_check.c
+ * @brief Verifica que os núcleos escalar, SSE2 e AVX2 geram os mesmos compartimentos.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "galton_board.h"
+
+#define CHECK_TICKS 200000
+
+static const unsigned seeds[] = {1, 42, 1234};
+
+static const struct {
+    galton_kernel_t kernel;
+    const char *name;
+} kernels[] = {
+    {GALTON_KERNEL_SSE2, "sse2"},
+    {GALTON_KERNEL_AVX2, "avx2"},
+};
+
+/**
+ * @brief Executa a simulação com uma semente e guarda os compartimentos.
+ * @param seed Semente de rand().
+ * @param out Saída com os NUM_BINS compartimentos.
+ * @return Total de bolas lançadas.
+ */
+static int run(unsigned seed, int *out) {
+    srand(seed);
+    current_tick = 0;
+    total_balls = 0;
+    galton_board_init();
+
+    for (int t = 0; t < CHECK_TICKS; t++) {
+        current_tick++;
+        galton_board_step();
+    }
+
+    memcpy(out, bins, sizeof(bins));
+    return total_balls;
+}
+
+int main(void) {
+    int failures = 0;
+
+    for (size_t s = 0; s < sizeof(seeds) / sizeof(seeds[0]); s++) {
+        int expected[NUM_BINS], actual[NUM_BINS];
+
+        galton_board_set_kernel(GALTON_KERNEL_SCALAR);
+        int expected_total = run(seeds[s], expected);
+
+        for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+            if (!galton_board_set_kernel(kernels[k].kernel)) {
+                printf("seed %u %s: indisponível, ignorado\n", seeds[s], kernels[k].name);
+                continue;
+            }
+
+            int total = run(seeds[s], actual);
+            bool same = total == expected_total && memcmp(expected, actual, sizeof(actual)) == 0;
+            printf("seed %u %s: %s\n", seeds[s], kernels[k].name, same ? "ok" : "DIFERENTE");
+            if (!same) failures++;
+        }
+    }
+
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
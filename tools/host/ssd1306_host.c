@@ -0,0 +1,18 @@
+/**
+ * @file ssd1306_host.c
+ * @brief Desenho em memória do SSD1306 para o build de host.
+ */
+
+#include "ssd1306.h"
+
+// Mesmo layout de páginas de ssd1306_i2c.c, sem acesso ao display
+void ssd1306_set_pixel(uint8_t *ssd, int x, int y, bool set) {
+    assert(x >= 0 && x < ssd1306_width && y >= 0 && y < ssd1306_height);
+
+    int byte_idx = (y / 8) * ssd1306_width + x;
+    if (set) {
+        ssd[byte_idx] |= 1 << (y % 8);
+    } else {
+        ssd[byte_idx] &= ~(1 << (y % 8));
+    }
+}
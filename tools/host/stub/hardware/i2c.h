@@ -0,0 +1,11 @@
+/**
+ * @file i2c.h
+ * @brief Stub mínimo de hardware/i2c.h para o build de host.
+ */
+
+#ifndef HARDWARE_I2C_HOST_H
+#define HARDWARE_I2C_HOST_H
+
+typedef struct i2c_inst i2c_inst_t;
+
+#endif // HARDWARE_I2C_HOST_H
@@ -0,0 +1,17 @@
+/**
+ * @file stdlib.h
+ * @brief Stub mínimo de pico/stdlib.h para o build de host.
+ */
+
+#ifndef PICO_STDLIB_HOST_H
+#define PICO_STDLIB_HOST_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <assert.h>
+
+#define _u(x) x##u
+#define count_of(a) (sizeof(a) / sizeof((a)[0]))
+
+#endif // PICO_STDLIB_HOST_H